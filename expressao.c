@@ -2,7 +2,6 @@
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
-#include <ctype.h>
 #include "expressao.h" // ALTERADO
 
 #ifdef _MSC_VER
@@ -64,18 +63,29 @@ static int pilhaStringVazia(Calculadora *calc) { return calc->topoString == -1;
 
 // --- Funções Auxiliares (static) ---
 
-static int ehOperador(char c) { return c == '+' || c == '-' || c == '*' || c == '/' || c == '%' || c == '^'; }
-static int ehFuncao(const char *s) {
-    const char *funcoes[] = {"raiz", "sen", "cos", "tg", "log", NULL};
-    for (int i = 0; funcoes[i]; i++) if (strcmp(s, funcoes[i]) == 0) return 1;
+static int ehEspaco(char c) { return c == ' ' || (c >= '\t' && c <= '\r'); }
+static int ehDigito(char c) { return c >= '0' && c <= '9'; }
+static int ehLetra(char c) { return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z'); }
+static int ehOperador(char c) {
+    return c == '+' || c == '-' || c == '*' || c == '/' || c == '%' || c == '^' || c == '<' || c == '>';
+}
+// Operadores de dois caracteres usam o primeiro caractere como marcador: "==" -> '=', "&&" -> '&', "||" -> '|'.
+static char marcadorDoOperador(const char *s, size_t len) {
+    if (len == 1 && ehOperador(s[0])) return s[0];
+    if (len == 2 && s[0] == s[1] && (s[0] == '=' || s[0] == '&' || s[0] == '|')) return s[0];
     return 0;
 }
 static int precedencia(char operador) {
     switch(operador) {
-        case '+': case '-': return 1;
-        case '*': case '/': case '%': return 2;
-        case '^': return 3;
-        case 'R': case 'S': case 'C': case 'T': case 'L': return 4; // Funções
+        case '?': case ':': return 1; // Ternário
+        case '|': return 2;
+        case '&': return 3;
+        case '=': return 4;
+        case '<': case '>': return 5;
+        case '+': case '-': return 6;
+        case '*': case '/': case '%': return 7;
+        case '^': return 8;
+        case 'R': case 'S': case 'C': case 'T': case 'L': return 9; // Funções
         default: return 0;
     }
 }
@@ -86,10 +96,27 @@ static int adicionar_operador_a_saida(char op, char* buf, int idx, size_t max_le
         case 'C': return snprintf(buf + idx, max_len - idx, "cos ");
         case 'T': return snprintf(buf + idx, max_len - idx, "tg ");
         case 'L': return snprintf(buf + idx, max_len - idx, "log ");
+        case '=': return snprintf(buf + idx, max_len - idx, "== ");
+        case '&': return snprintf(buf + idx, max_len - idx, "&& ");
+        case '|': return snprintf(buf + idx, max_len - idx, "|| ");
+        case ':': return snprintf(buf + idx, max_len - idx, "?: ");
         default:  return snprintf(buf + idx, max_len - idx, "%c ", op);
     }
 }
+// NaN marca um erro matemático adiado: '&&' e '||' só o propagam a partir do
+// operando que decide o resultado, os demais operadores sempre o propagam.
 static float realizaOperacao(char op, float op2, float op1) {
+    switch (op) {
+        case '&':
+            if (isnan(op1)) return NAN;
+            if (op1 == 0) return 0.0f;
+            return isnan(op2) ? NAN : (float)(op2 != 0);
+        case '|':
+            if (isnan(op1)) return NAN;
+            if (op1 != 0) return 1.0f;
+            return isnan(op2) ? NAN : (float)(op2 != 0);
+    }
+    if (isnan(op1) || isnan(op2)) return NAN;
     switch (op) {
         case '+': return op1 + op2;
         case '-': return op1 - op2;
@@ -97,20 +124,36 @@ static float realizaOperacao(char op, float op2, float op1) {
         case '/': return op2 != 0 ? op1 / op2 : NAN;
         case '%': return op2 != 0 ? fmod(op1, op2) : NAN;
         case '^': return pow(op1, op2);
+        case '<': return op1 < op2;
+        case '>': return op1 > op2;
+        case '=': return op1 == op2;
         default: return NAN;
     }
 }
-static float realizaFuncao(const char *func, float op) {
-    if (strcmp(func, "raiz") == 0) return op >= 0 ? sqrt(op) : NAN;
-    if (strcmp(func, "log") == 0) return op > 0 ? log10(op) : NAN;
+static float realizaSelecao(float cond, float se_verdadeiro, float se_falso) {
+    if (isnan(cond)) return NAN;
+    return cond != 0 ? se_verdadeiro : se_falso;
+}
+static char marcadorDaFuncao(const char *s, size_t len) {
+    if (len == 4 && strncmp(s, "raiz", 4) == 0) return 'R';
+    if (len == 3 && strncmp(s, "sen", 3) == 0) return 'S';
+    if (len == 3 && strncmp(s, "cos", 3) == 0) return 'C';
+    if (len == 2 && strncmp(s, "tg", 2) == 0) return 'T';
+    if (len == 3 && strncmp(s, "log", 3) == 0) return 'L';
+    return 0;
+}
+static float realizaFuncao(char marcador, float op) {
     double ang_rad = op * M_PI / 180.0;
-    if (strcmp(func, "sen") == 0) return sin(ang_rad);
-    if (strcmp(func, "cos") == 0) return cos(ang_rad);
-    if (strcmp(func, "tg") == 0) {
-        if (fmod(op, 180.0) == 90.0 || fmod(op, 180.0) == -90.0) return NAN;
-        return tan(ang_rad);
+    switch (marcador) {
+        case 'R': return op >= 0 ? sqrt(op) : NAN;
+        case 'L': return op > 0 ? log10(op) : NAN;
+        case 'S': return sin(ang_rad);
+        case 'C': return cos(ang_rad);
+        case 'T':
+            if (fmod(op, 180.0) == 90.0 || fmod(op, 180.0) == -90.0) return NAN;
+            return tan(ang_rad);
+        default: return NAN;
     }
-    return NAN;
 }
 
 
@@ -147,47 +190,31 @@ char* converter_infixo_para_posfixo(Calculadora* calc, const char* infixa) {
     int esperando_operando = 1;
 
     while (infixa[i] != '\0' && (size_t)k < buffer_len -1) {
-        if (isspace(infixa[i])) { i++; continue; }
-
-        if (isdigit(infixa[i]) || (infixa[i] == '.' && isdigit(infixa[i+1]))) {
-            char num_buf[64];
-            int j = 0;
-            while (j < 63 && (isdigit(infixa[i]) || infixa[i] == '.')) num_buf[j++] = infixa[i++];
-            num_buf[j] = '\0';
-            k += snprintf(posfixa + k, buffer_len - k, "%s ", num_buf);
-            esperando_operando = 0;
-            continue;
-        }
-        
-        if (esperando_operando && infixa[i] == '-') {
-            char num_buf[64];
-            int j = 0;
-            num_buf[j++] = infixa[i++];
-            while (j < 63 && (isdigit(infixa[i]) || infixa[i] == '.')) num_buf[j++] = infixa[i++];
-            num_buf[j] = '\0';
-            k += snprintf(posfixa + k, buffer_len - k, "%s ", num_buf);
+        if (ehEspaco(infixa[i])) { i++; continue; }
+
+        if (ehDigito(infixa[i]) || (infixa[i] == '.' && ehDigito(infixa[i+1])) ||
+            (esperando_operando && infixa[i] == '-')) {
+            // Copia o número inteiro (com o '-' unário) direto para a saída.
+            int inicio = i++;
+            while (ehDigito(infixa[i]) || infixa[i] == '.') i++;
+            memcpy(posfixa + k, infixa + inicio, i - inicio);
+            k += i - inicio;
+            posfixa[k++] = ' ';
             esperando_operando = 0;
             continue;
         }
 
-        if (isalpha(infixa[i])) {
-            char func_buf[10];
-            int j = 0;
-            while (j < 9 && isalpha(infixa[i])) func_buf[j++] = infixa[i++];
-            func_buf[j] = '\0';
-            if (!ehFuncao(func_buf)) { free(posfixa); return NULL; }
-            char marcador = 0;
-            if (strcmp(func_buf, "raiz") == 0) marcador = 'R';
-            else if (strcmp(func_buf, "sen") == 0) marcador = 'S';
-            else if (strcmp(func_buf, "cos") == 0) marcador = 'C';
-            else if (strcmp(func_buf, "tg") == 0) marcador = 'T';
-            else if (strcmp(func_buf, "log") == 0) marcador = 'L';
-            empilhaChar(calc, marcador);
+        if (ehLetra(infixa[i])) {
+            int inicio = i;
+            while (ehLetra(infixa[i])) i++;
+            char marcador = marcadorDaFuncao(infixa + inicio, i - inicio);
+            if (!marcador) { free(posfixa); return NULL; }
+            if (!empilhaChar(calc, marcador)) { free(posfixa); return NULL; }
             continue;
         }
 
         if (infixa[i] == '(') {
-            empilhaChar(calc, '(');
+            if (!empilhaChar(calc, '(')) { free(posfixa); return NULL; }
             esperando_operando = 1;
             i++;
             continue;
@@ -195,11 +222,12 @@ char* converter_infixo_para_posfixo(Calculadora* calc, const char* infixa) {
         
         if (infixa[i] == ')') {
             while (!pilhaCharVazia(calc) && topoPilhaChar(calc) != '(') {
+                if (topoPilhaChar(calc) == '?') { free(posfixa); return NULL; } // '?' sem ':'
                 k += adicionar_operador_a_saida(desempilhaChar(calc), posfixa, k, buffer_len);
             }
             if (pilhaCharVazia(calc)) { free(posfixa); return NULL; } // Parênteses desbalanceados
             desempilhaChar(calc); // Pop '('
-            if (!pilhaCharVazia(calc) && isalpha(topoPilhaChar(calc))) {
+            if (!pilhaCharVazia(calc) && ehLetra(topoPilhaChar(calc))) {
                  k += adicionar_operador_a_saida(desempilhaChar(calc), posfixa, k, buffer_len);
             }
             i++;
@@ -207,25 +235,51 @@ char* converter_infixo_para_posfixo(Calculadora* calc, const char* infixa) {
             continue;
         }
 
-        if (ehOperador(infixa[i])) {
-            int assoc_dir = (infixa[i] == '^');
+        if (infixa[i] == '?') {
             while (!pilhaCharVazia(calc) && topoPilhaChar(calc) != '(' &&
-                   (precedencia(topoPilhaChar(calc)) > precedencia(infixa[i]) ||
-                   (precedencia(topoPilhaChar(calc)) == precedencia(infixa[i]) && !assoc_dir))) {
+                   precedencia(topoPilhaChar(calc)) > precedencia('?')) {
+                k += adicionar_operador_a_saida(desempilhaChar(calc), posfixa, k, buffer_len);
+            }
+            if (!empilhaChar(calc, '?')) { free(posfixa); return NULL; }
+            i++;
+            esperando_operando = 1;
+            continue;
+        }
+
+        if (infixa[i] == ':') {
+            while (!pilhaCharVazia(calc) && topoPilhaChar(calc) != '(' && topoPilhaChar(calc) != '?') {
                 k += adicionar_operador_a_saida(desempilhaChar(calc), posfixa, k, buffer_len);
             }
-            empilhaChar(calc, infixa[i]);
+            if (topoPilhaChar(calc) != '?') { free(posfixa); return NULL; } // ':' sem '?'
+            desempilhaChar(calc);
+            empilhaChar(calc, ':'); // Ternário completo, aguardando o operando do ':'
             i++;
             esperando_operando = 1;
             continue;
         }
+
+        size_t tam_op = 2;
+        char op = marcadorDoOperador(infixa + i, tam_op);
+        if (!op) op = marcadorDoOperador(infixa + i, tam_op = 1);
+        if (op) {
+            int assoc_dir = (op == '^');
+            while (!pilhaCharVazia(calc) && topoPilhaChar(calc) != '(' &&
+                   (precedencia(topoPilhaChar(calc)) > precedencia(op) ||
+                   (precedencia(topoPilhaChar(calc)) == precedencia(op) && !assoc_dir))) {
+                k += adicionar_operador_a_saida(desempilhaChar(calc), posfixa, k, buffer_len);
+            }
+            if (!empilhaChar(calc, op)) { free(posfixa); return NULL; } // Pilha cheia
+            i += tam_op;
+            esperando_operando = 1;
+            continue;
+        }
         
         free(posfixa); return NULL; // Caractere inválido
     }
 
     while(!pilhaCharVazia(calc)) {
         char op = desempilhaChar(calc);
-        if (op == '(') { free(posfixa); return NULL; } // Parênteses desbalanceados
+        if (op == '(' || op == '?') { free(posfixa); return NULL; } // Parênteses desbalanceados ou '?' sem ':'
         k += adicionar_operador_a_saida(op, posfixa, k, buffer_len);
     }
 
@@ -242,11 +296,11 @@ char* converter_posfixo_para_infixo(Calculadora* calc, const char* posfixa) {
 
     char* token = strtok(copia_posfixa, " ");
     while(token) {
-        if (isdigit(token[0]) || (token[0] == '-' && strlen(token) > 1) || token[0] == '.') {
+        if (ehDigito(token[0]) || (token[0] == '-' && strlen(token) > 1) || token[0] == '.') {
             if (!empilhaString(calc, token)) {
                 free(copia_posfixa); limparPilhaString(calc); return NULL;
             }
-        } else if (ehOperador(token[0]) && strlen(token) == 1) {
+        } else if (marcadorDoOperador(token, strlen(token))) {
             char* op2 = desempilhaString(calc);
             char* op1 = desempilhaString(calc);
             if (!op1 || !op2) { free(op1); free(op2); free(copia_posfixa); limparPilhaString(calc); return NULL; }
@@ -260,7 +314,24 @@ char* converter_posfixo_para_infixo(Calculadora* calc, const char* posfixa) {
                 free(buffer); free(op1); free(op2); free(copia_posfixa); limparPilhaString(calc); return NULL;
             }
             free(buffer); free(op1); free(op2);
-        } else if (ehFuncao(token)) {
+        } else if (strcmp(token, "?:") == 0) {
+            char* se_falso = desempilhaString(calc);
+            char* se_verdadeiro = desempilhaString(calc);
+            char* cond = desempilhaString(calc);
+            if (!cond || !se_verdadeiro || !se_falso) {
+                free(cond); free(se_verdadeiro); free(se_falso); free(copia_posfixa); limparPilhaString(calc); return NULL;
+            }
+
+            size_t len = strlen(cond) + strlen(se_verdadeiro) + strlen(se_falso) + 12;
+            char* buffer = malloc(len);
+            if(!buffer) { free(cond); free(se_verdadeiro); free(se_falso); free(copia_posfixa); limparPilhaString(calc); return NULL; }
+
+            snprintf(buffer, len, "( %s ? %s : %s )", cond, se_verdadeiro, se_falso);
+            if (!empilhaString(calc, buffer)) {
+                free(buffer); free(cond); free(se_verdadeiro); free(se_falso); free(copia_posfixa); limparPilhaString(calc); return NULL;
+            }
+            free(buffer); free(cond); free(se_verdadeiro); free(se_falso);
+        } else if (marcadorDaFuncao(token, strlen(token))) {
             char* op1 = desempilhaString(calc);
             if (!op1) { free(copia_posfixa); limparPilhaString(calc); return NULL; }
 
@@ -288,37 +359,40 @@ CalcStatus calcular_valor_posfixo(Calculadora* calc, const char* posfixa, float*
     if (!calc || !posfixa || !resultado) return CALC_ERRO_DESCONHECIDO;
     limparPilhaFloat(calc);
 
-    char* copia_posfixa = strdup(posfixa);
-    if (!copia_posfixa) return CALC_ERRO_MEMORIA;
-
-    char* token = strtok(copia_posfixa, " ");
-    while(token) {
-        if (isdigit(token[0]) || (token[0] == '-' && strlen(token) > 1) || token[0] == '.') {
-            if (!empilhaFloat(calc, atof(token))) { free(copia_posfixa); return CALC_ERRO_MEMORIA; }
-        } else if (ehOperador(token[0]) && strlen(token) == 1) {
+    // Lê os tokens direto da string do chamador: sem cópia nem strtok a cada avaliação.
+    // Erros matemáticos ficam na pilha como NaN até o fim, para que '&&', '||' e '?:'
+    // possam descartar o lado não escolhido (ex.: "x > 0 ? 1 / x : 0").
+    const char* token = posfixa;
+    while (*token) {
+        if (*token == ' ') { token++; continue; }
+        size_t len = strcspn(token, " ");
+        char marcador;
+
+        if (ehDigito(token[0]) || (token[0] == '-' && len > 1) || token[0] == '.') {
+            if (!empilhaFloat(calc, strtof(token, NULL))) return CALC_ERRO_MEMORIA;
+        } else if ((marcador = marcadorDoOperador(token, len)) != 0) {
+            if (calc->topoFloat < 1) return CALC_ERRO_SINTAXE;
             float op2 = desempilhaFloat(calc);
             float op1 = desempilhaFloat(calc);
-            if (isnan(op1) || isnan(op2)) { free(copia_posfixa); return CALC_ERRO_SINTAXE; }
-            float res = realizaOperacao(token[0], op2, op1);
-            if (isnan(res)) { free(copia_posfixa); return CALC_ERRO_MATEMATICO; }
-            if (!empilhaFloat(calc, res)) { free(copia_posfixa); return CALC_ERRO_MEMORIA; }
-        } else if (ehFuncao(token)) {
-            float op1 = desempilhaFloat(calc);
-            if (isnan(op1)) { free(copia_posfixa); return CALC_ERRO_SINTAXE; }
-            float res = realizaFuncao(token, op1);
-            if (isnan(res)) { free(copia_posfixa); return CALC_ERRO_MATEMATICO; }
-            if (!empilhaFloat(calc, res)) { free(copia_posfixa); return CALC_ERRO_MEMORIA; }
+            if (!empilhaFloat(calc, realizaOperacao(marcador, op2, op1))) return CALC_ERRO_MEMORIA;
+        } else if (len == 2 && strncmp(token, "?:", 2) == 0) {
+            if (calc->topoFloat < 2) return CALC_ERRO_SINTAXE;
+            float se_falso = desempilhaFloat(calc);
+            float se_verdadeiro = desempilhaFloat(calc);
+            float cond = desempilhaFloat(calc);
+            if (!empilhaFloat(calc, realizaSelecao(cond, se_verdadeiro, se_falso))) return CALC_ERRO_MEMORIA;
+        } else if ((marcador = marcadorDaFuncao(token, len)) != 0) {
+            if (pilhaFloatVazia(calc)) return CALC_ERRO_SINTAXE;
+            if (!empilhaFloat(calc, realizaFuncao(marcador, desempilhaFloat(calc)))) return CALC_ERRO_MEMORIA;
         } else {
-            free(copia_posfixa); return CALC_ERRO_SINTAXE;
+            return CALC_ERRO_SINTAXE;
         }
-        token = strtok(NULL, " ");
+        token += len;
     }
-    free(copia_posfixa);
 
+    if (calc->topoFloat != 0) return CALC_ERRO_SINTAXE;
     float final_res = desempilhaFloat(calc);
-    if (isnan(final_res) || !pilhaFloatVazia(calc)) {
-        return CALC_ERRO_SINTAXE;
-    }
+    if (isnan(final_res)) return CALC_ERRO_MATEMATICO;
 
     *resultado = final_res;
     return CALC_SUCESSO;
@@ -1,5 +1,6 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <math.h> 
 #include "expressao.h" // ALTERADO
 
@@ -67,12 +68,36 @@ int main() {
     testar_expressao(calc, "sen(45)^2 + 0.5", 1.0f, 0);
     testar_expressao(calc, "raiz(64) % 3", 2.0f, 0);
     testar_expressao(calc, "-5 * (-3 + 1)", 10.0f, 0);
+    testar_expressao(calc, "\t12.5 *\n.5 + raiz(16)", 10.25f, 0);
+    testar_expressao(calc, "3 < 4 && 2 > 1", 1.0f, 0);
+    testar_expressao(calc, "2 + 2 == 4 || 1 / 0", 1.0f, 0);
+    testar_expressao(calc, "0 && 1 / 0", 0.0f, 0);
+    testar_expressao(calc, "0 > 1 ? 1 / 0 : raiz(9)", 3.0f, 0);
+    testar_expressao(calc, "1 ? 0 ? 5 : 6 : 7", 6.0f, 0);
+    testar_expressao(calc, "0 ? 5 : 1 ? 6 : 7", 6.0f, 0);
 
     printf("\n--- Testes de Erro ---\n");
     testar_expressao(calc, "10 / 0", 0.0f, 1); // Espera-se um erro de cálculo
     testar_expressao(calc, "5 + * 3", 0.0f, 1); // Espera-se um erro de sintaxe
     testar_expressao(calc, "(10 + 2", 0.0f, 1); // Espera-se um erro de sintaxe
 
+    // 300 '^' associativos à direita ficam todos na pilha de operadores (limite 256):
+    // a conversão deve falhar em vez de descartar operadores silenciosamente.
+    char potencias[1024] = "1";
+    for (int i = 0; i < 300; i++) strcat(potencias, "^1");
+    printf("----------------------------------------\n");
+    printf("Expressao Infixa: \"1^1^...^1\" (300 operadores)\n");
+    char* posfixa_cheia = converter_infixo_para_posfixo(calc, potencias);
+    if (!posfixa_cheia) {
+        printf(">> SUCESSO: Pilha de operadores cheia capturada na conversao.\n");
+    } else {
+        printf(">> FALHA: Conversao aceitou a expressao com a pilha de operadores cheia.\n");
+        free(posfixa_cheia);
+    }
+    testar_expressao(calc, "1 > 0 ? 1 / 0 : 2", 0.0f, 1); // Espera-se um erro de cálculo no ramo escolhido
+    testar_expressao(calc, "(1 ? 2) : 3", 0.0f, 1); // Espera-se um erro de sintaxe
+    testar_expressao(calc, "1 = 1", 0.0f, 1); // Espera-se um erro de sintaxe
+
     printf("----------------------------------------\n");
     printf("Destruindo instancia da calculadora...\n");
     destruir_calculadora(calc);